@@ -16,9 +16,9 @@ doublereal ddot_(integer *n, doublereal *dx, integer *incx, doublereal *dy,
     doublereal ret_val;
 
     /* Local variables */
-    static integer i, m;
-    static doublereal dtemp;
-    static integer ix, iy, mp1;
+    static __thread integer i, m;
+    static __thread doublereal dtemp;
+    static __thread integer ix, iy, mp1;
 
 
 /*     forms the dot product of two vectors.
@@ -18,12 +18,12 @@
 	    i__3;
 
     /* Local variables */
-    static integer info;
-    static logical nota, notb;
-    static doublereal temp;
-    static integer i, j, l, ncola;
+    static __thread integer info;
+    static __thread logical nota, notb;
+    static __thread doublereal temp;
+    static __thread integer i, j, l, ncola;
     extern logical lsame_(char *, char *);
-    static integer nrowa, nrowb;
+    static __thread integer nrowa, nrowb;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
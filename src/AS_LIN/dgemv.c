@@ -16,11 +16,11 @@
     integer a_dim1, a_offset, i__1, i__2;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer lenx, leny, i, j;
+    static __thread integer info;
+    static __thread doublereal temp;
+    static __thread integer lenx, leny, i, j;
     extern logical lsame_(const char *, const char *);
-    static integer ix, iy, jx, jy, kx, ky;
+    static __thread integer ix, iy, jx, jy, kx, ky;
     extern /* Subroutine */ int xerbla_(const char *, integer *);
 
 
@@ -47,25 +47,25 @@ doublereal dlamch_(char *cmach)
 */
 /* >>Start of File<<
        Initialized data */
-    static logical first = TRUE_;
+    static __thread logical first = TRUE_;
     /* System generated locals */
     integer i__1;
     doublereal ret_val;
     /* Builtin functions */
     double pow_di(doublereal *, integer *);
     /* Local variables */
-    static doublereal base;
-    static integer beta;
-    static doublereal emin, prec, emax;
-    static integer imin, imax;
-    static logical lrnd;
-    static doublereal rmin, rmax, t, rmach;
+    static __thread doublereal base;
+    static __thread integer beta;
+    static __thread doublereal emin, prec, emax;
+    static __thread integer imin, imax;
+    static __thread logical lrnd;
+    static __thread doublereal rmin, rmax, t, rmach;
     extern logical lsame_(char *, char *);
-    static doublereal small, sfmin;
+    static __thread doublereal small, sfmin;
     extern /* Subroutine */ int dlamc2_(integer *, integer *, logical *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *);
-    static integer it;
-    static doublereal rnd, eps;
+    static __thread integer it;
+    static __thread doublereal rnd, eps;
 
 
 
@@ -181,19 +181,19 @@ nding
    =====================================================================
 */
     /* Initialized data */
-    static logical first = TRUE_;
+    static __thread logical first = TRUE_;
     /* System generated locals */
     doublereal d__1, d__2;
     /* Local variables */
-    static logical lrnd;
-    static doublereal a, b, c, f;
-    static integer lbeta;
-    static doublereal savec;
+    static __thread logical lrnd;
+    static __thread doublereal a, b, c, f;
+    static __thread integer lbeta;
+    static __thread doublereal savec;
     extern doublereal dlamc3_(doublereal *, doublereal *);
-    static logical lieee1;
-    static doublereal t1, t2;
-    static integer lt;
-    static doublereal one, qtr;
+    static __thread logical lieee1;
+    static __thread doublereal t1, t2;
+    static __thread integer lt;
+    static __thread doublereal one, qtr;
 
 
 
@@ -412,33 +412,33 @@ L30:
     static integer c__1 = 1;
 
     /* Initialized data */
-    static logical first = TRUE_;
-    static logical iwarn = FALSE_;
+    static __thread logical first = TRUE_;
+    static __thread logical iwarn = FALSE_;
     /* System generated locals */
     integer i__1;
     doublereal d__1, d__2, d__3, d__4, d__5;
     /* Builtin functions */
     double pow_di(doublereal *, integer *);
     /* Local variables */
-    static logical ieee;
-    static doublereal half;
-    static logical lrnd;
-    static doublereal leps, zero, a, b, c;
-    static integer i, lbeta;
-    static doublereal rbase;
-    static integer lemin, lemax, gnmin;
-    static doublereal small;
-    static integer gpmin;
-    static doublereal third, lrmin, lrmax, sixth;
+    static __thread logical ieee;
+    static __thread doublereal half;
+    static __thread logical lrnd;
+    static __thread doublereal leps, zero, a, b, c;
+    static __thread integer i, lbeta;
+    static __thread doublereal rbase;
+    static __thread integer lemin, lemax, gnmin;
+    static __thread doublereal small;
+    static __thread integer gpmin;
+    static __thread doublereal third, lrmin, lrmax, sixth;
     extern /* Subroutine */ int dlamc1_(integer *, integer *, logical *,
 	    logical *);
     extern doublereal dlamc3_(doublereal *, doublereal *);
-    static logical lieee1;
+    static __thread logical lieee1;
     extern /* Subroutine */ int dlamc4_(integer *, doublereal *, integer *),
 	    dlamc5_(integer *, integer *, integer *, logical *, integer *,
 	    doublereal *);
-    static integer lt, ngnmin, ngpmin;
-    static doublereal one, two;
+    static __thread integer lt, ngnmin, ngpmin;
+    static __thread doublereal one, two;
 
 
 
@@ -722,11 +722,11 @@ doublereal dlamc3_(doublereal *a, doublereal *b)
     integer i__1;
     doublereal d__1;
     /* Local variables */
-    static doublereal zero, a;
-    static integer i;
-    static doublereal rbase, b1, b2, c1, c2, d1, d2;
+    static __thread doublereal zero, a;
+    static __thread integer i;
+    static __thread doublereal rbase, b1, b2, c1, c2, d1, d2;
     extern doublereal dlamc3_(doublereal *, doublereal *);
-    static doublereal one;
+    static __thread doublereal one;
 
 
 
@@ -837,14 +837,14 @@ L10:
     integer i__1;
     doublereal d__1;
     /* Local variables */
-    static integer lexp;
-    static doublereal oldy;
-    static integer uexp, i;
-    static doublereal y, z;
-    static integer nbits;
+    static __thread integer lexp;
+    static __thread doublereal oldy;
+    static __thread integer uexp, i;
+    static __thread doublereal y, z;
+    static __thread integer nbits;
     extern doublereal dlamc3_(doublereal *, doublereal *);
-    static doublereal recbas;
-    static integer exbits, expsum, try__;
+    static __thread doublereal recbas;
+    static __thread integer exbits, expsum, try__;
 
 
 
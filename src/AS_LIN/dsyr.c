@@ -15,11 +15,11 @@
     integer a_dim1, a_offset, i__1, i__2;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer i, j;
+    static __thread integer info;
+    static __thread doublereal temp;
+    static __thread integer i, j;
     extern logical lsame_(char *, char *);
-    static integer ix, jx, kx;
+    static __thread integer ix, jx, kx;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
@@ -16,12 +16,12 @@
     integer a_dim1, a_offset, c_dim1, c_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer i, j, l;
+    static __thread integer info;
+    static __thread doublereal temp;
+    static __thread integer i, j, l;
     extern logical lsame_(char *, char *);
-    static integer nrowa;
-    static logical upper;
+    static __thread integer nrowa;
+    static __thread logical upper;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
@@ -15,13 +15,13 @@
     integer a_dim1, a_offset, i__1, i__2, i__3, i__4;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer i, j, l;
+    static __thread integer info;
+    static __thread doublereal temp;
+    static __thread integer i, j, l;
     extern logical lsame_(char *, char *);
-    static integer kplus1, ix, jx, kx;
+    static __thread integer kplus1, ix, jx, kx;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static logical nounit;
+    static __thread logical nounit;
 
 
 /*  Purpose
@@ -16,15 +16,15 @@
     integer a_dim1, a_offset, b_dim1, b_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer i, j, k;
-    static logical lside;
+    static __thread integer info;
+    static __thread doublereal temp;
+    static __thread integer i, j, k;
+    static __thread logical lside;
     extern logical lsame_(char *, char *);
-    static integer nrowa;
-    static logical upper;
+    static __thread integer nrowa;
+    static __thread logical upper;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static logical nounit;
+    static __thread logical nounit;
 
 
 /*  Purpose
@@ -15,8 +15,8 @@ integer idamax_(integer *n, doublereal *dx, integer *incx)
     doublereal d__1;
 
     /* Local variables */
-    static doublereal dmax__;
-    static integer i, ix;
+    static __thread doublereal dmax__;
+    static __thread integer i, ix;
 
 
 /*     finds the index of element having max. absolute value.
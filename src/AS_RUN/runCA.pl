@@ -533,6 +533,12 @@ sub setDefaults () {
     $global{"ovlStoreMemory"}              = 1024;
     $synops{"ovlStoreMemory"}              = "How much memory (MB) to use when constructing overlap stores";
 
+    $global{"ovlStoreThreads"}             = 1;
+    $synops{"ovlStoreThreads"}             = "Number of threads to use when sorting overlaps for overlap stores";
+
+    $global{"ovlStoreCompress"}            = 0;
+    $synops{"ovlStoreCompress"}            = "Build compressed (version 3) overlap stores";
+
     $global{"ovlThreads"}                  = 2;
     $synops{"ovlThreads"}                  = "Number of threads to use when computing overlaps";
 
@@ -759,6 +765,9 @@ sub setDefaults () {
     $global{"extendClearRangesStepSize"}   = undef;
     $synops{"extendClearRangesStepSize"}   = "Batch N scaffolds per ECR run";
 
+    $global{"extendClearRangesThreads"}    = undef;
+    $synops{"extendClearRangesThreads"}    = "Number of threads to use for aligning extensions in each ECR run; default is whatever OpenMP wants";
+
     $global{"kickOutNonOvlContigs"}        = 0;
     $synops{"kickOutNonOvlContigs"}        = "Allow kicking out a contig placed in a scaffold by mate pairs that has no overlaps to both its left and right neighbor contigs. EXPERT!\n";
 
@@ -788,6 +797,9 @@ sub setDefaults () {
     $global{"cnsConcurrency"}              = 2;
     $synops{"cnsConcurrency"}              = "If not SGE, number of consensus jobs to run at the same time";
 
+    $global{"cnsThreads"}                  = undef;
+    $synops{"cnsThreads"}                  = "Number of threads to use for computing unitig consensus in each job; default 1";
+
     $global{"cnsPhasing"}                  = 0;
     $synops{"cnsPhasing"}                  = "Options for consensus phasing of SNPs\n\t0 - Do not phase SNPs to be consistent.\n\t1 - If two SNPs are joined by reads, phase them to be consistent.";
 
@@ -3513,6 +3525,7 @@ sub merOverlapper($) {
         $cmd .= " -o $wrk/$outDir/$asm.merStore.WORKING";
         $cmd .= " -g $wrk/$asm.gkpStore";
         $cmd .= " -M " . getGlobal("ovlStoreMemory");
+        $cmd .= " -threads " . getGlobal("ovlStoreThreads");
         $cmd .= " -L $wrk/$outDir/$asm.merStore.list";
         $cmd .= " > $wrk/$outDir/$asm.merStore.err 2>&1";
 
@@ -3951,6 +3964,8 @@ sub createOverlapStore {
     }
 
     $cmd .= " -M " . getGlobal("ovlStoreMemory");
+    $cmd .= " -threads " . getGlobal("ovlStoreThreads");
+    $cmd .= " -compress" if (getGlobal("ovlStoreCompress") == 1);
     $cmd .= " -L $wrk/$asm.ovlStore.list ";
     $cmd .= " > $wrk/$asm.ovlStore.err 2>&1";
 
@@ -4075,6 +4090,7 @@ sub overlapTrim {
         $cmd .= " -o $wrk/0-overlaptrim/$asm.obtStore.BUILDING ";
         $cmd .= " -g $wrk/$asm.gkpStore ";
         $cmd .= " -M " . getGlobal('ovlStoreMemory');
+        $cmd .= " -threads " . getGlobal('ovlStoreThreads');
         $cmd .= " -L $wrk/0-overlaptrim/$asm.obtStore.list";
         $cmd .= " > $wrk/0-overlaptrim/$asm.obtStore.err 2>&1";
 
@@ -4116,6 +4132,7 @@ sub overlapTrim {
             $cmd .= " -o $wrk/0-overlaptrim/$asm.dupStore.BUILDING \\\n";
             $cmd .= " -g $wrk/$asm.gkpStore \\\n";
             $cmd .= " -M \\\n" . getGlobal('ovlStoreMemory');
+            $cmd .= " -threads " . getGlobal('ovlStoreThreads') . " \\\n";
             $cmd .= " -L $wrk/0-overlaptrim/$asm.dupStore.list \\\n";
             $cmd .= " > $wrk/0-overlaptrim/$asm.dupStore.err 2>&1";
 
@@ -4875,6 +4892,7 @@ sub createPostUnitiggerConsensusJobs (@) {
         print F "  -g $wrk/$asm.gkpStore \\\n";
         print F "  -t $wrk/$asm.tigStore 1 \$jobid \\\n";
         print F "  -maxcoverage $maxCov \\\n";
+        print F "  -threads " . getGlobal("cnsThreads") . " \\\n" if (defined(getGlobal("cnsThreads")));
         print F "> $wrk/5-consensus/${asm}_\$jobid.cns.err 2>&1 \\\n";
         print F "&& \\\n";
         print F "\$bin/utgcnsfix \\\n";
@@ -5424,6 +5442,7 @@ sub eCR ($$$) {
                 print F " -c $asm \\\n";
                 print F " -b $curScaffold -e $endScaffold \\\n";
                 print F " -i $iter \\\n";
+                print F " -threads " . getGlobal("extendClearRangesThreads") . " \\\n" if (defined(getGlobal("extendClearRangesThreads")));
                 print F " > $j.err 2>&1\n";
                 close(F);
 